@@ -6,193 +6,178 @@
 #include "../../utilities/utilities.h"
 #include "../first_pass/first_pass_utility.h"
 #include "../../utilities/error_utility.h"
-
-
-/* Extracts operand label from the provided operand string */
-bool extract_label(const char *operand, char **label) {
-
-    int i = 1;
-
-    /* The first letter in the label can only be an alphabetic letter */
-    if (!isalpha(operand[0])) { /**< Check if the first character is an alphabetic letter */
-        return FALSE;
-    }
-
-    /* Check the rest of the label syntax */
-    while (operand[i] != '\0' && isalnum(operand[i])) {
-        ++i;
-    }
-
-    /* Ensure that there is nothing other than whitespace after the last label character */
-    while (operand[i] != '\0') {
-        if (!isspace(operand[i])) {
-            return FALSE;
+#include "../../utilities/tables_utility.h"
+
+
+/* Classifies a command instruction operand and parses its payload in a single scan */
+AddressingType classify_operand(char *operand, ClassifiedOperand *classified) {
+
+    size_t i, j;          /**< Indexes into the operand string */
+    bool isClosed;        /**< Represents whether the label index is closed by ']' */
+    bool isLabelValid;    /**< Represents whether the fixed index label is valid */
+    bool isIndexValid;    /**< Represents whether the label index is valid */
+
+    classified->addressingType = NONE_ADDR;
+    classified->isValid = FALSE;
+    classified->label.start = NULL;
+    classified->label.length = 0;
+    classified->isInteger = FALSE;
+    classified->integerValue = 0;
+    classified->constant.start = NULL;
+    classified->constant.length = 0;
+    classified->reg = NONE_REG;
+
+    /* Check if the addressing is an 'immediate addressing' (0) */
+    if (operand[0] == '#') {
+
+        classified->addressingType = IMMEDIATE_ADDR;
+        operand++; /**< Move the pointer after the '#' */
+
+        /* The value is represented by an integer */
+        if (extract_number(operand, &classified->integerValue)) {
+            classified->isInteger = TRUE;
+            classified->isValid = TRUE;
+            return IMMEDIATE_ADDR;
         }
-        ++i;
-    }
 
-    *label = string_duplicate(operand);
-
-    if (*label == NULL) {
-        handle_memory_allocation_failure();
-        return FALSE;
-    }
-
-    return TRUE;
-}
-
-/* Extracts a label from a fixed index addressing operand */
-bool fixed_index_addressing_label_Extraction(const char *operand, char **label) {
+        /* The value is represented by a constant, which can only start with an alphabetic letter */
+        if (!isalpha(operand[0])) {
+            return IMMEDIATE_ADDR;
+        }
 
-    size_t length;
-    /* Find the position of '[' in string 'operand' */
-    const char *pos = strchr(operand, '[');
+        i = 1;
+        while (isalnum(operand[i])) {
+            ++i;
+        }
 
-    /* The first letter in the label can only be an alphabetic letter */
-    if (!isalpha(operand[0])) { /**< Check if the first character is an alphabetic letter */
-        return FALSE;
-    }
+        classified->constant.start = operand;
+        classified->constant.length = i;
 
-    /* Checks if the subject is extracting a label from the inside of the parentheses */
-    if (pos == NULL) {
-        pos = strchr(operand, ']');
-    }
+        /* Ensure that there is nothing other than whitespace after the last constant character */
+        while (isspace(operand[i])) {
+            ++i;
+        }
+        classified->isValid = operand[i] == '\0';
 
-    if (pos == NULL) {
-        return FALSE; /**< Return false if '[' or ']' are not found */
+        return IMMEDIATE_ADDR;
     }
 
-    length = (size_t) (pos - operand);  /**< Calculate the length if the parentheses is found */
-
-    /* Allocate memory for the new string (including null terminator) */
-    *label = (char *) validated_memory_allocation(length + 1);
-
-    /* Copy the substring to string 'label' */
-    strncpy(*label, operand, length);
+    /* Direct addressing (1) and fixed index addressing (2) start with a label */
+    if (isalpha(operand[0])) {
 
-    /* Ensure null-termination of string 'label' */
-    (*label)[length] = '\0';
+        i = 1;
+        while (isalnum(operand[i])) {
+            ++i;
+        }
 
-    /* Check the label syntax */
-    if (!check_symbol_syntax(*label)) {
-        return FALSE;
-    }
+        classified->label.start = operand;
+        classified->label.length = i;
 
-    return TRUE;
-}
+        /* Check if the addressing is a 'direct addressing' (1) */
+        for(j = i ; isspace(operand[j]) ; ++j);
+        if (operand[j] == '\0' && !is_reserved_operand_span(&classified->label)) {
+            classified->addressingType = DIRECT_ADDR;
+            classified->isValid = TRUE;
+            return DIRECT_ADDR;
+        }
 
-/* Check if operand string represents operand valid fixed index memory address */
-bool is_fixed_index_addressing(const char *word) {
+        /* Check if the addressing is a 'fixed index addressing' (2) */
+        if (operand[i] == '[') {
 
-    int i, j;
+            /* Only alphanumeric characters can be inside the brackets */
+            for(j = i + 1 ; isalnum(operand[j]) ; ++j);
 
-    /* The first letter in the label can only be an alphabetic letter */
-    if (!isalpha(word[0])) { /**< Check if the first character is an alphabetic letter */
-        return FALSE;
-    }
+            isClosed = operand[j] == ']';
+            classified->constant.start = operand + i + 1;
+            classified->constant.length = j - (i + 1);
 
-    i = 1;
-    /* Check the rest of the label syntax */
-    while (word[i] != '\0' && isalnum(word[i])) {
-        ++i;
-    }
-
-    /* Check for the opening bracket '[' */
-    if (word[i] != '[') {
-        return FALSE;
-    }
+            /* Ensure that there is nothing other than whitespace after the closing bracket ']' */
+            if (isClosed) {
+                ++j;
+            }
+            while (isspace(operand[j])) {
+                ++j;
+            }
 
-    /* Only alphanumeric characters can be inside the brackets */
-    for(j = i + 1 ; word[j] != '\0' && word[j] != ']' ; ++j) {
-        if (!isalnum(word[j])) {
-            return FALSE;
+            if (operand[j] == '\0') {
+
+                classified->addressingType = FIXED_IDX_ADDR;
+                isLabelValid = classified->label.length <= MAX_SYMBOL_LENGTH;
+
+                /* Check if the label index represented by an integer or a constant */
+                if (extract_number(operand + i + 1, &classified->integerValue)) {
+                    classified->isInteger = TRUE;
+                    classified->constant.start = NULL;
+                    classified->constant.length = 0;
+                    isIndexValid = TRUE;
+                }
+                else {
+                    isIndexValid = isClosed && isalpha(*classified->constant.start) &&
+                                   classified->constant.length <= MAX_SYMBOL_LENGTH;
+                }
+
+                classified->isValid = isLabelValid && isIndexValid;
+                return FIXED_IDX_ADDR;
+            }
         }
-    }
 
-    /* Moves the pointer after the closing brackets */
-    if (word[j] == ']') {
-        j++;
+        classified->label.start = NULL;
+        classified->label.length = 0;
+        classified->constant.start = NULL;
+        classified->constant.length = 0;
     }
 
-    /* Ensure that there is nothing other than whitespace after the closing bracket ']' */
-    while (word[j] != '\0') {
-        if (!isspace(word[j])) {
-            return FALSE;
-        }
-        ++j;
+    /* Check if the addressing is a 'direct register addressing' (3) */
+    classified->reg = get_register(operand);
+    if (classified->reg != NONE_REG) {
+        classified->addressingType = DIRECT_REGISTER_ADDR;
+        classified->isValid = TRUE;
     }
 
-    return TRUE;
-}
-
-/* Check if operand string represents operand valid direct register addressing operand */
-bool is_direct_register_addressing(const char *word) {
-
-    if (get_register(word) == NONE_REG)
-        return FALSE;
-    return TRUE;
+    return classified->addressingType;
 }
 
-/* Check if operand string represents operand valid direct addressing operand */
-bool is_direct_addressing(const char *word) {
+/* Checks if an operand span is a reserved word */
+bool is_reserved_operand_span(const OperandSpan *span) {
 
-    int i;
-    char *tempWord; /**< A temporary pointer to store the word */
+    size_t i;
 
-    /* The first letter in the label can only be an alphabetic letter */
-    if (!isalpha(word[0])) { /**< Check if the first character is an alphabetic letter */
-        return FALSE;
+    for(i = 0 ; i < NUM_OF_RESERVED_WORDS_EXTENDED ; ++i) {
+        if (strlen(ReservedWordsExtended[i]) == span->length &&
+            strncmp(span->start, ReservedWordsExtended[i], span->length) == 0) {
+            return TRUE; /**< The span is a reserved word */
+        }
     }
 
-    i = 1;
-    /* Check the rest of the label syntax */
-    while (word[i] != '\0' && isalnum(word[i])) {
-        ++i;
-    }
+    return FALSE;
+}
 
-    /* Ensure that there is nothing other than whitespace after the last label character */
-    while (word[i] != '\0') {
-        if (!isspace(word[i])) {
-            return FALSE;
-        }
-        ++i;
-    }
+/* Duplicates an operand span into a newly allocated string */
+char *duplicate_operand_span(const OperandSpan *span) {
 
-    safe_word_extraction_until_comma(word, &tempWord); /**< Extract the word to check if it's a reserved word */
+    /* Allocate memory for the new string (including null terminator) */
+    char *str = (char *) validated_memory_allocation(span->length + 1);
 
-    /* Check if the word is a reserved word */
-    if (is_reserved_word_extended(tempWord)) {
-        free(tempWord); /**< Free allocated memory */
-        return FALSE;
-    }
+    /* Copy the span and null-terminate the new string */
+    strncpy(str, span->start, span->length);
+    str[span->length] = '\0';
 
-    free(tempWord); /**< Free allocated memory */
-    return TRUE;
+    return str;
 }
 
 /* Handles immediate addressing for an assembly language instruction operand */
-void handle_immediate_addressing(char *operand, OperandType operandType, AbstractLineDescriptor *line_descriptor) {
-
-    int integerValue;     /**< An integer value for immediate addressing */
-    char *constantSymbol; /**< The name of a constant (defined by '.define') */
-    bool isValue;         /**< Represents whether the addressing will be represented by an integer */
-    bool isConstant;      /**< Represents whether the addressing will be represented by a constant */
-
-    operand++; /**< Move the pointer after the '#' */
-
-    /* Check if the operand value represented by an integer or operand constant */
-    isValue = extract_number(operand, &integerValue); /**< True if the operand represented by an integer */
-    isConstant = extract_label(operand, &constantSymbol); /**< True if the operand represented by a constant */
+void handle_immediate_addressing(const ClassifiedOperand *classified, OperandType operandType,
+                                 AbstractLineDescriptor *line_descriptor) {
 
     /* Insert the values to the line descriptor */
-    if (isValue) { /**< The operand represented by an integer */
-        handle_immediate_value(operandType, integerValue, &line_descriptor->instructionType.commandInst);
+    if (!classified->isValid) { /**< The operand is not a valid integer or constant */
+        insert_error(line_descriptor, IMMEDIATE_ADDR_OP_ERR);
     }
-    else if (isConstant) { /**< The operand represented by a constant */
-        handle_immediate_constant(operandType, constantSymbol, &line_descriptor->instructionType.commandInst);
+    else if (classified->isInteger) { /**< The operand represented by an integer */
+        handle_immediate_value(operandType, classified->integerValue, &line_descriptor->instructionType.commandInst);
     }
-    else { /**< If reach here, there must be an error */
-        insert_error(line_descriptor, IMMEDIATE_ADDR_OP_ERR);
+    else { /**< The operand represented by a constant */
+        handle_immediate_constant(operandType, &classified->constant, &line_descriptor->instructionType.commandInst);
     }
 }
 
@@ -216,7 +201,7 @@ void handle_immediate_value(OperandType operandType, int integerValue, CommandIn
 }
 
 /* Handles immediate constant for the line descriptor */
-void handle_immediate_constant(OperandType operandType, char *constantSymbol, CommandInstruction *cmdInst) {
+void handle_immediate_constant(OperandType operandType, const OperandSpan *constantSymbol, CommandInstruction *cmdInst) {
 
     /* Check for valid input */
     if (cmdInst == NULL) {
@@ -224,83 +209,53 @@ void handle_immediate_constant(OperandType operandType, char *constantSymbol, Co
     }
 
     if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
-        cmdInst->sourceOperand.immediateValue.constantVal = string_duplicate(constantSymbol);
-        if (cmdInst->sourceOperand.immediateValue.constantVal == NULL) {
-            cmdInst->sourceOperand.immediateValue.constantVal = NULL; /**< Set to NULL to avoid dangling pointers */
-            handle_memory_allocation_failure();
-        }
+        cmdInst->sourceOperand.immediateValue.constantVal = duplicate_operand_span(constantSymbol);
     }
     else { /**< True if it's a target operand */
-        cmdInst->targetOperand.immediateValue.constantVal = string_duplicate(constantSymbol);
-        if (cmdInst->targetOperand.immediateValue.constantVal == NULL) {
-            cmdInst->targetOperand.immediateValue.constantVal = NULL; /**< Set to NULL to avoid dangling pointers */
-            handle_memory_allocation_failure();
-        }
+        cmdInst->targetOperand.immediateValue.constantVal = duplicate_operand_span(constantSymbol);
     }
 }
 
-/* Handles immediate addressing */
-void handle_direct_addressing(char *operand, OperandType operandType, AbstractLineDescriptor *line_descriptor) {
+/* Handles direct addressing */
+void handle_direct_addressing(const ClassifiedOperand *classified, OperandType operandType,
+                              AbstractLineDescriptor *line_descriptor) {
 
-    char *label; /**< The label name */
-
-    /* Extract the label */
-    if (!extract_label(operand, &label)) { /**< True if the label extraction failed */
+    /* Check the label */
+    if (!classified->isValid) { /**< True if the label is not valid */
         insert_error(line_descriptor, DIRECT_ADDR_OP_ERR);
         return;
     }
 
     /* Select if it's a source operand or a target operand */
     if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
-        line_descriptor->instructionType.commandInst.sourceOperand.addressingLabel = string_duplicate(label);
-        if (line_descriptor->instructionType.commandInst.sourceOperand.addressingLabel ==
-            NULL) { /**< True if the memory allocation failed */
-            handle_memory_allocation_failure();
-        }
+        line_descriptor->instructionType.commandInst.sourceOperand.addressingLabel =
+                duplicate_operand_span(&classified->label);
     }
     else { /**< True if it's a target operand */
-        line_descriptor->instructionType.commandInst.targetOperand.addressingLabel = string_duplicate(label);
-        if (line_descriptor->instructionType.commandInst.targetOperand.addressingLabel ==
-            NULL) { /**< True if the memory allocation failed */
-            handle_memory_allocation_failure();
-        }
+        line_descriptor->instructionType.commandInst.targetOperand.addressingLabel =
+                duplicate_operand_span(&classified->label);
     }
 }
 
 /* Handles fixed index addressing */
-void handle_fixed_index_addressing(char *operand, OperandType operandType, AbstractLineDescriptor *line_descriptor) {
+void handle_fixed_index_addressing(const ClassifiedOperand *classified, OperandType operandType,
+                                   AbstractLineDescriptor *line_descriptor) {
 
-    char *label;          /**< The label name */
-    int integerValue;     /**< An integer value for the label index */
-    char *constantSymbol; /**< A constant defined by '.define' for the label index */
-    bool isInteger;       /**< Represents whether the label index will be represented by an integer */
-    bool isConstant;      /**< Represents whether the label index will be represented by a constant */
-    bool noErrors;        /**< Indicates if there is an error */
-
-    /* Extract the label */
-    if (!fixed_index_addressing_label_Extraction(operand, &label)) {
+    /* Check the label and the label index */
+    if (!classified->isValid) {
         insert_error(line_descriptor, COMMAND_INST_ERR FIXED_IDX_ADDR_OP_ERR);
+        return;
     }
 
-    MOVE_POINTER_AFTER_BRACKET(operand) /**< Move the pointer after the '[' */
-
-    /* Check if the label index represented by an integer or operand constant */
-    isInteger = extract_number(operand, &integerValue); /**< True if the label index represented by an integer */
-    isConstant = fixed_index_addressing_label_Extraction(operand, &constantSymbol); /**< True if the label index represented by a constant */
-
     /* Insert the label of the fixed index addressing to the line descriptor */
-    insert_fixed_index_label(operandType, label, &line_descriptor->instructionType.commandInst);
+    insert_fixed_index_label(operandType, &classified->label, &line_descriptor->instructionType.commandInst);
 
-    /* Insert the values to the line descriptor */
-    noErrors = handle_fixed_index_indexing(operandType, isInteger, isConstant, integerValue, constantSymbol,
-                                           &line_descriptor->instructionType.commandInst);
-
-    if (!noErrors)
-        insert_error(line_descriptor, COMMAND_INST_ERR FIXED_IDX_ADDR_OP_ERR);
+    /* Insert the label index to the line descriptor */
+    handle_fixed_index_indexing(operandType, classified, &line_descriptor->instructionType.commandInst);
 }
 
 /* Handles fixed index operand label insertion */
-void insert_fixed_index_label(OperandType operandType, char *label, CommandInstruction *cmdInst) {
+void insert_fixed_index_label(OperandType operandType, const OperandSpan *label, CommandInstruction *cmdInst) {
 
     /* Check for valid input */
     if (cmdInst == NULL) {
@@ -309,87 +264,58 @@ void insert_fixed_index_label(OperandType operandType, char *label, CommandInstr
 
     /* Select if it's a source operand or a target operand */
     if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
-        cmdInst->sourceOperand.fixedIndexOperand.labelName = string_duplicate(label);
-        if (cmdInst->sourceOperand.fixedIndexOperand.labelName == NULL) {
-            handle_memory_allocation_failure();
-        }
+        cmdInst->sourceOperand.fixedIndexOperand.labelName = duplicate_operand_span(label);
     }
     else { /**< True if it's a target operand */
-        cmdInst->targetOperand.fixedIndexOperand.labelName = string_duplicate(label);
-        if (cmdInst->targetOperand.fixedIndexOperand.labelName == NULL) {
-            handle_memory_allocation_failure();
-        }
+        cmdInst->targetOperand.fixedIndexOperand.labelName = duplicate_operand_span(label);
     }
 }
 
 /* Handles fixed index operand indexing */
-bool handle_fixed_index_indexing(OperandType operandType, bool isInteger, bool isConstant, int integerValue,
-                                 char *constantSymbol, CommandInstruction *cmdInst) {
+void handle_fixed_index_indexing(OperandType operandType, const ClassifiedOperand *classified,
+                                 CommandInstruction *cmdInst) {
+
+    FixedIndexAddressing *fixedIndexOperand; /**< The fixed index operand to update */
 
     /* Check for valid input */
     if (cmdInst == NULL) {
-        return FALSE;
+        return;
     }
 
-    if (isInteger) { /**< The label index represented by an integer */
-
-        /* Select if it's a source operand or a target operand */
-        if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
-            cmdInst->sourceOperand.fixedIndexOperand.numericalAddressingIndex = integerValue;
-            cmdInst->sourceOperand.fixedIndexOperand.constantAddressingIndex = NULL; /**< Set to NULL to avoid dangling pointers */
-        }
-        else { /**< True if it's a target operand */
-            cmdInst->targetOperand.fixedIndexOperand.numericalAddressingIndex = integerValue;
-            cmdInst->targetOperand.fixedIndexOperand.constantAddressingIndex = NULL; /**< Set to NULL to avoid dangling pointers */
-        }
-
-        /* Line descriptor's update has been completed */
-        return TRUE;
+    /* Select if it's a source operand or a target operand */
+    if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
+        fixedIndexOperand = &cmdInst->sourceOperand.fixedIndexOperand;
     }
-
-    if (isConstant) { /**< The label index represented by a constant */
-        /* Select if it's a source operand or a target operand */
-        if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
-            cmdInst->sourceOperand.fixedIndexOperand.constantAddressingIndex = string_duplicate(constantSymbol);
-            if (cmdInst->sourceOperand.fixedIndexOperand.constantAddressingIndex == NULL) {
-                handle_memory_allocation_failure();
-                return FALSE;
-            }
-        }
-        else { /**< True if it's a target operand */
-            cmdInst->targetOperand.fixedIndexOperand.constantAddressingIndex = string_duplicate(constantSymbol);
-            if (cmdInst->targetOperand.fixedIndexOperand.constantAddressingIndex == NULL) {
-                handle_memory_allocation_failure();
-                return FALSE;
-            }
-        }
-
-        /* Line descriptor's update has been completed */
-        return TRUE;
+    else { /**< True if it's a target operand */
+        fixedIndexOperand = &cmdInst->targetOperand.fixedIndexOperand;
     }
 
-    /* If reach here, there must be an error */
-    return FALSE;
+    if (classified->isInteger) { /**< The label index represented by an integer */
+        fixedIndexOperand->numericalAddressingIndex = classified->integerValue;
+        fixedIndexOperand->constantAddressingIndex = NULL; /**< Set to NULL to avoid dangling pointers */
+    }
+    else { /**< The label index represented by a constant */
+        fixedIndexOperand->constantAddressingIndex = duplicate_operand_span(&classified->constant);
+    }
 }
 
 /* Handles direct register addressing */
-void handle_direct_register_addressing(char *operand, OperandType operandType, AbstractLineDescriptor *line_descriptor) {
+void handle_direct_register_addressing(const ClassifiedOperand *classified, OperandType operandType,
+                                       AbstractLineDescriptor *line_descriptor) {
 
-    /* Get the register of the direct register addressing */
-    Register reg = get_register(operand);
     /* Check if it's a valid register name */
-    if (reg == NONE_REG) {
+    if (!classified->isValid) {
         insert_error(line_descriptor, COMMAND_INST_ERR DIRECT_REG_OP_ERR);
         return;
     }
 
-    /* Insert the label of the direct register addressing to the line descriptor */
+    /* Insert the register of the direct register addressing to the line descriptor */
     /* Select if it's a source operand or a target operand */
     if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
-        line_descriptor->instructionType.commandInst.sourceOperand.reg = reg;
+        line_descriptor->instructionType.commandInst.sourceOperand.reg = classified->reg;
     }
 
     else { /**< True if it's a target operand */
-        line_descriptor->instructionType.commandInst.targetOperand.reg = reg;
+        line_descriptor->instructionType.commandInst.targetOperand.reg = classified->reg;
     }
-}
\ No newline at end of file
+}
@@ -122,6 +122,76 @@ typedef struct {
     int target; /**< Number of mods for the target operand. */
 } addressingModes;
 
+/**
+ * @struct OperandSpan
+ * @brief Represents a substring of an operand string without copying it.
+ *
+ * The OperandSpan structure points into the original operand string and records the length
+ * of the relevant part, so the operand classifier can report labels and constants without
+ * allocating memory.
+ *
+ * @var OperandSpan::start
+ * Pointer to the first character of the substring inside the operand string.
+
+ * @var OperandSpan::length
+ * The number of characters in the substring.
+ *
+ * @example
+ * For the operand "LIST[k]", the label span starts at 'L' with length 4,
+ * and the index constant span starts at 'k' with length 1.
+ */
+typedef struct {
+    const char *start; /**< The first character of the substring. */
+    size_t length;     /**< The number of characters in the substring. */
+} OperandSpan;
+
+/**
+ * @struct ClassifiedOperand
+ * @brief Represents the result of classifying a command instruction operand in a single scan.
+ *
+ * The ClassifiedOperand structure holds the addressing type of an operand together with its parsed payload,
+ * so the addressing handlers only store the results in the line descriptor without parsing the operand again.
+ *
+ * @var ClassifiedOperand::addressingType
+ * The addressing type of the operand, or NONE_ADDR if the operand is not recognized.
+
+ * @var ClassifiedOperand::isValid
+ * Indicates whether the payload is valid for the detected addressing type.
+
+ * @var ClassifiedOperand::label
+ * The label for direct addressing (1) or fixed index addressing (2).
+
+ * @var ClassifiedOperand::isInteger
+ * Indicates whether the immediate value (0) or the label index (2) is represented by an integer.
+
+ * @var ClassifiedOperand::integerValue
+ * The immediate value (0) or the label index (2) when represented by an integer.
+
+ * @var ClassifiedOperand::constant
+ * The constant (defined by '.define') of the immediate value (0) or the label index (2).
+
+ * @var ClassifiedOperand::reg
+ * The register for direct register addressing (3).
+ *
+ * @remark Payload by addressing type:
+ * | Addressing Type      | Payload                                           |
+ * | -------------------- | ------------------------------------------------- |
+ * | IMMEDIATE_ADDR       | integerValue or constant                          |
+ * | DIRECT_ADDR          | label                                             |
+ * | FIXED_IDX_ADDR       | label, and integerValue or constant for the index |
+ * | DIRECT_REGISTER_ADDR | reg                                               |
+ * | -------------------- | ------------------------------------------------- |
+ */
+typedef struct {
+    AddressingType addressingType; /**< The addressing type of the operand. */
+    bool isValid;                  /**< Whether the payload is valid for the addressing type. */
+    OperandSpan label;             /**< The label for direct or fixed index addressing. */
+    bool isInteger;                /**< Whether the value or index is represented by an integer. */
+    int integerValue;              /**< The integer value of the immediate value or the index. */
+    OperandSpan constant;          /**< The constant of the immediate value or the index. */
+    Register reg;                  /**< The register for direct register addressing. */
+} ClassifiedOperand;
+
 /**
  * @var opcodeAddressingDictionary
  * @brief Array of OpcodeAddressing representing a dictionary for opcode addressing types.
@@ -197,296 +267,156 @@ extern const OpcodeAddressing opcodeAddressingDict[NUMBER_OF_OPCODES];
 extern const addressingModes addressingModesDict[];
 
 /**
- * @brief Extracts a label from the provided operand string.
- *
- * Attempts to extract a label from the given operand string and allocates memory to store the result.
- * The caller is responsible for freeing the allocated memory after use.
- *
- * @param operand The string containing the potential label.
- * @param label Pointer to the variable where the extracted label will be stored.
- * @return true if a valid label is successfully extracted, false otherwise.
- *
- * @remark Valid Label:
- * - The first character must be an alphabetic letter.
- * - Following characters can be alphanumeric.
- * - No characters other than whitespace are allowed after the last label character.
- *
- * @example
- * \code
- * const char *operand = "Label123";
- * char *extractedLabel;
- * bool success = extract_label(operand, &extractedLabel);
- * // success is now true, and extractedLabel contains the allocated memory with "Label123".
- * // Remember to free extractedLabel after use to avoid memory leaks.
- * \endcode
- */
-bool extract_label(const char *operand, char **label);
-
-/**
- * @brief Extracts a label from a fixed index addressing operand, considering parentheses.
- *
- * This function extracts a label from the provided operand, considering fixed index addressing format
- * and checking for parentheses. The label is identified as the substring from the beginning of the operand
- * up to the '[' or ']' character.
+ * @brief Classifies a command instruction operand and parses its payload in a single scan.
  *
- * @param operand The operand string with fixed index addressing.
- * @param label A pointer to store the extracted label.
+ * Determines the addressing type of the operand and, in the same pass over the string, extracts
+ * the immediate value or constant, the label, the label index or the register number. No memory
+ * is allocated: labels and constants are reported as spans into the operand string.
  *
- * @return true if the label extraction is successful, false otherwise.
+ * @param operand The operand string to classify.
+ * @param classified A pointer to the ClassifiedOperand structure to be filled.
+ * @return The addressing type of the operand, or NONE_ADDR if the operand is not recognized.
  *
- * @note
- * Ensure that the pointer to the operand is at the beginning of the label before calling this function.
- * This function assumes that the provided operand follows fixed index addressing format.
+ * @remark Classification Rules:
+ * - Immediate addressing (0): '#' followed by an integer or a constant name.
+ * - Direct addressing (1): a label that is not a reserved word.
+ * - Fixed index addressing (2): a label followed by an alphanumeric index enclosed in square brackets.
+ * - Direct register addressing (3): a register name (r0 - r7).
  *
- * @remark Usage
- * Called to extract a label from an operand with fixed index addressing format.
- *
- * @examples
- * 1. Extracting a label from a fixed index addressing operand:
- * \code
- *    const char *operand = "label[2]";
- *    char *extractedLabel;
- *    if (fixed_index_addressing_label_Extraction(operand, &extractedLabel)) {
- *        // extractedLabel now holds the label "label".
- *        // Proceed with further processing.
- *    } else {
- *        // Label extraction failed. Handle the failure accordingly.
- *    }
- *\endcode
- *
- * 2. Handling a case where the first letter is not an alphabetic letter:
- * \code
- *    const char *operand = "123[4]";
- *    char *extractedLabel;
- *    if (fixed_index_addressing_label_Extraction(operand, &extractedLabel)) {
- *        // This block won't be executed as the label extraction will fail.
- *    } else {
- *        // Label extraction failed. Handle the failure accordingly.
- *    }
- * \endcode
- *
- * 3. Checking the syntax of a label with parentheses:
- * \code
- *    const char *operand = "labelWithParentheses]";
- *    char *extractedLabel;
- *    if (fixed_index_addressing_label_Extraction(operand, &extractedLabel)) {
- *        // This block won't be executed as the label syntax check will fail.
- *    } else {
- *        // Label extraction or syntax check failed. Handle the failure accordingly.
- *    }
- * \endcode
- */
-bool fixed_index_addressing_label_Extraction(const char *operand, char **label);
-
-/**
- * @brief Check if a string represents a valid fixed index memory address.
- *
- * Validates whether the provided string adheres to the syntax of a fixed index memory address.
- *
- * @param word The string representing the memory address.
- * @return true if the string is a valid fixed index memory address, false otherwise.
- *
- * @remark Syntax Guidelines:
- * - The first character must be an alphabetic letter.
- * - Following characters can be alphanumeric.
- * - The address must be enclosed in square brackets '[ ]' whithout spacing.
- * - Only alphanumeric characters are allowed inside the brackets.
- * - After the closing bracket there should be no characters other than whitespace.
+ * @note If the addressing type is recognized but the payload is not valid (e.g. "#a-b"), the addressing type is
+ *       returned and the `isValid` field is set to false.
  *
  * @example
  * \code
- * const char *address = "STR[2]";
- * bool isValid = is_fixed_index_addressing(address);
- * // isValid is now TRUE as the address follows the valid syntax.
+ * ClassifiedOperand classified;
+ * if (classify_operand("LIST[k]", &classified) == FIXED_IDX_ADDR && classified.isValid) {
+ *     // classified.label spans "LIST" and classified.constant spans "k".
+ * }
  * \endcode
  */
-bool is_fixed_index_addressing(const char *word);
+AddressingType classify_operand(char *operand, ClassifiedOperand *classified);
 
 /**
- * @brief Check if a string represents a valid direct register addressing operand.
+ * @brief Checks if an operand span is a reserved word.
  *
- * Validates whether the provided string represents a valid direct register addressing operand.
+ * Compares the span against the extended set of reserved words (including register names and opcode names)
+ * without copying it into a null-terminated string.
  *
- * @param word The string representing the addressing mode.
- * @return true if the string is a valid direct register addressing operand, false otherwise.
- *
- * @remark Valid Register Names:
- * - Valid register names are obtained using the `get_register` function.
- * - The function checks if the provided string corresponds to a valid register name.
- *
- * @example
- * \code
- * const char *addressingOperand = "r1";
- * bool isValid = is_direct_register_addressing(addressingMode);
- * // isValid is now TRUE as "r1" is a valid direct register operand mode.
- * \endcode
+ * @param span The span to check.
+ * @return true if the span is a reserved word, false otherwise.
  */
-bool is_direct_register_addressing(const char *word);
+bool is_reserved_operand_span(const OperandSpan *span);
 
 /**
- * @brief Check if a string represents a valid direct addressing operand.
- *
- * Validates whether the provided string represents a valid direct addressing operand.
+ * @brief Duplicates an operand span into a newly allocated null-terminated string.
  *
- * @param word The string representing the addressing operand.
- * @return true if the string is a valid direct addressing operand, false otherwise.
+ * @param span The span to duplicate.
+ * @return A pointer to the duplicated string. Memory must be freed by the caller.
  *
- * @remark Valid Syntax:
- * - The first character must be an alphabetic letter.
- * - Following characters can be alphanumeric.
- * - No characters other than whitespace are allowed after the last label character.
- *
- * @example
- * \code
- * const char *addressingOperand = "Label123";
- * bool isValid = is_direct_addressing(addressingOperand);
- * // isValid is now TRUE as "Label123" is a valid direct addressing operand.
- * \endcode
+ * @note Memory allocation failure is handled by `validated_memory_allocation`.
  */
-bool is_direct_addressing(const char *word);
+char *duplicate_operand_span(const OperandSpan *span);
 
 /**
  * @brief Handles immediate addressing for an assembly language instruction operand.
  *
- * This function processes an operand represented by immediate addressing, extracting the integer or constant value
- * following the '#' symbol. It then updates the provided line descriptor based on the operand type (source or target).
+ * This function stores the integer or constant value of a classified immediate addressing operand
+ * in the provided line descriptor based on the operand type (source or target).
  *
- * @param operand The operand string representing immediate addressing.
+ * @param classified The classified operand representing immediate addressing.
  * @param operandType The type of operand (source or target) in the instruction.
  * @param line_descriptor The pointer to the AbstractLineDescriptor structure to be updated.
  *
- * @var integerVal The integer value for immediate addressing.
- * @var constantSymbol The name of a constant defined by '.define'.
- * @var isValue Represents whether the addressing is represented by an integer.
- * @var isConstant Represents whether the addressing is represented by a constant.
- *
  * @remark Usage
  * Called to handle immediate addressing for a given operand in an assembly language instruction.
  *
  * @examples
  * 1. Processing a numerical constant:
- *    OperandType operandType = SOURCE_OPERAND;
+ *    ClassifiedOperand classified;
  *    AbstractLineDescriptor myLineDescriptor;
- *    handle_immediate_addressing("#42", operandType, &myLineDescriptor);
+ *    classify_operand("#42", &classified);
+ *    handle_immediate_addressing(&classified, SOURCE_OPERAND, &myLineDescriptor);
  *    // Updates the source operand of myLineDescriptor with the integer value 42.
  *
  * 2. Processing a constant defined by '.define':
- *    OperandType operandType = TARGET_OPERAND;
+ *    ClassifiedOperand classified;
  *    AbstractLineDescriptor myLineDescriptor;
- *    handle_immediate_addressing("#constantValue", operandType, &myLineDescriptor);
+ *    classify_operand("#constantValue", &classified);
+ *    handle_immediate_addressing(&classified, TARGET_OPERAND, &myLineDescriptor);
  *    // Updates the target operand of myLineDescriptor with the constant value represented by 'constantValue'.
  */
-void handle_immediate_addressing(char *operand, OperandType operandType, AbstractLineDescriptor *line_descriptor);
+void handle_immediate_addressing(const ClassifiedOperand *classified, OperandType operandType,
+                                 AbstractLineDescriptor *line_descriptor);
 
 /**
  * @brief Handles direct addressing for an assembly language instruction operand.
  *
- * This function processes an operand represented by direct addressing, extracting the label name.
- * It then updates the provided line descriptor based on the operand type (source or target).
+ * This function stores the label of a classified direct addressing operand in the provided line descriptor
+ * based on the operand type (source or target).
  *
- * @param operand The operand string representing direct addressing.
+ * @param classified The classified operand representing direct addressing.
  * @param operandType The type of operand (source or target) in the instruction.
  * @param line_descriptor The pointer to the AbstractLineDescriptor structure to be updated.
  *
- * @var label The label name for direct addressing.
- *
  * @remark Usage
  * Called to handle direct addressing for a given operand in an assembly language instruction.
  *
  * @examples
- * 1. Processing a source direct addressing operand:
- *    OperandType operandType = SOURCE_OPERAND;
+ *    ClassifiedOperand classified;
  *    AbstractLineDescriptor myLineDescriptor;
- *    handle_direct_addressing("label1", operandType, &myLineDescriptor);
+ *    classify_operand("label1", &classified);
+ *    handle_direct_addressing(&classified, SOURCE_OPERAND, &myLineDescriptor);
  *    // Updates the source operand of myLineDescriptor with the label named "label1".
- *
- * 2. Processing a target direct addressing operand:
- *    OperandType operandType = TARGET_OPERAND;
- *    AbstractLineDescriptor myLineDescriptor;
- *    handle_direct_addressing("label2", operandType, &myLineDescriptor);
- *    // Updates the target operand of myLineDescriptor with the label named "label2".
  */
-void handle_direct_addressing(char *operand, OperandType operandType, AbstractLineDescriptor *line_descriptor);
+void handle_direct_addressing(const ClassifiedOperand *classified, OperandType operandType,
+                              AbstractLineDescriptor *line_descriptor);
 
 /**
  * @brief Handles fixed index addressing for an assembly language instruction operand.
  *
- * This function processes an operand represented by fixed index addressing, extracting the label,
- * integer value, or constant symbol for the index. It then updates the provided line descriptor
- * based on the operand type (source or target).
+ * This function stores the label and the index (integer value or constant symbol) of a classified
+ * fixed index addressing operand in the provided line descriptor based on the operand type (source or target).
  *
- * @param operand The operand string representing fixed index addressing.
+ * @param classified The classified operand representing fixed index addressing.
  * @param operandType The type of operand (source or target) in the instruction.
  * @param line_descriptor The pointer to the AbstractLineDescriptor structure to be updated.
  *
- * @var label The label name for fixed index addressing.
- * @var integerVal An integer value for the label index.
- * @var constantSymbol The name of a constant defined by '.define' for the label index.
- * @var isValue Represents whether the label index is represented by an integer.
- * @var isConstant Represents whether the label index is represented by a constant.
- *
  * @remark Usage
  * Called to handle fixed index addressing for a given operand in an assembly language instruction.
  *
  * @examples
- * 1. Processing a fixed index addressing operand with an integer index:
  * \code
- *    OperandType operandType = SOURCE_OPERAND;
+ *    ClassifiedOperand classified;
  *    AbstractLineDescriptor myLineDescriptor;
- *    handle_fixed_index_addressing("label[42]", operandType, &myLineDescriptor);
+ *    classify_operand("label[42]", &classified);
+ *    handle_fixed_index_addressing(&classified, SOURCE_OPERAND, &myLineDescriptor);
  *    // Updates the source operand of myLineDescriptor with the label "label" and index 42.
  * \endcode
- *
- * 2. Processing a fixed index addressing operand with a constant index:
- * \code
- *    OperandType operandType = TARGET_OPERAND;
- *    AbstractLineDescriptor myLineDescriptor;
- *    handle_fixed_index_addressing("constantLabel[INDEX]", operandType, &myLineDescriptor);
- *    // Updates the target operand of myLineDescriptor with the label "constantLabel" and index represented by "INDEX".
- * \endcode
  */
-void handle_fixed_index_addressing(char *operand, OperandType operandType, AbstractLineDescriptor *line_descriptor);
+void handle_fixed_index_addressing(const ClassifiedOperand *classified, OperandType operandType,
+                                   AbstractLineDescriptor *line_descriptor);
 
 /**
- * @brief Handles fixed index addressing for command operands.
- *
- * This function handles fixed index addressing for command operands, extracting the label, determining whether
- * the index is represented by an integer or a constant symbol, and updating the abstract line descriptor
- * with the appropriate information. It also ensures proper error handling and updates the line descriptor
- * with any errors encountered during the process.
- *
- * @param[in] operand - The operand containing the fixed index addressing.
- * @param[in] operandType - The type of the operand (source or target).
- * @param[in, out] line_descriptor - A pointer to the abstract line descriptor to be updated.
- *
- * @note This function assumes that the abstract line descriptor (line_descriptor) is properly initialized.
- * @note Fixed index addressing is used for specifying memory locations in command operands.
- * @note The operand may contain a label followed by an index enclosed in square brackets.
- * @note The index can be represented by either an integer value or a constant symbol defined by '.define'.
- * @note Proper error handling is implemented to detect and report errors encountered during the process.
+ * @brief Handles direct register addressing for an assembly language instruction operand.
  *
- * @remark The handle_fixed_index_addressing function is essential for processing command operands with fixed index addressing,
- *          extracting label information, determining the representation of the index, and updating the line descriptor accordingly.
+ * This function stores the register of a classified direct register addressing operand in the provided
+ * line descriptor based on the operand type (source or target).
  *
- * @algorithm
- * 1. Extract the label from the operand.
- * 2. Move the operand pointer after the '[' character to handle fixed index addressing.
- * 3. Determine whether the label index is represented by an integer or a constant symbol.
- * 4. Insert the label of the fixed index addressing into the line descriptor.
- * 5. Handle fixed index indexing based on the representation of the index.
- * 6. Update the line descriptor with any errors encountered during the process.
+ * @param classified The classified operand representing direct register addressing.
+ * @param operandType The type of operand (source or target) in the instruction.
+ * @param line_descriptor The pointer to the AbstractLineDescriptor structure to be updated.
  *
  * @example
- * Example of usage:
  * \code
- * char *operand = "LABEL[10]";
- * OperandType operandType = SOURCE_OPERAND;
+ * ClassifiedOperand classified;
  * AbstractLineDescriptor line_descriptor;
- * // Assume line_descriptor is properly initialized
- * handle_fixed_index_addressing(operand, operandType, &line_descriptor);
+ * classify_operand("r3", &classified);
+ * handle_direct_register_addressing(&classified, TARGET_OPERAND, &line_descriptor);
+ * // Updates the target operand of line_descriptor with the register R3.
  * \endcode
  */
-void handle_direct_register_addressing(char *operand, OperandType operandType, AbstractLineDescriptor *line_descriptor);
+void handle_direct_register_addressing(const ClassifiedOperand *classified, OperandType operandType,
+                                       AbstractLineDescriptor *line_descriptor);
 
 /**
  * @brief Handles an immediate value for the line descriptor.
@@ -513,17 +443,16 @@ void handle_immediate_value(OperandType operandType, int integerValue, CommandIn
  * of the immediate operand based on the provided operand type (source or target).
  *
  * @param[in] operandType - The type of operand (source or target) to handle.
- * @param[in] constantSymbol - The constant symbol representing the immediate operand.
+ * @param[in] constantSymbol - The span of the constant symbol representing the immediate operand.
  * @param[in,out] cmdInst - A pointer to the command instruction line descriptor.
  *
  * @note This function assumes that the provided command instruction pointer is not NULL.
  * @note If the operand type is SOURCE_OPERAND, the constant value is set for the source operand.
  * @note If the operand type is TARGET_OPERAND, the constant value is set for the target operand.
- * @note Memory allocation failure is handled by printing an error message and setting the constant value to NULL.
  *
  * @remark The handle_immediate_constant function is used to handle immediate constants in command instructions.
  */
-void handle_immediate_constant(OperandType operandType, char *constantSymbol, CommandInstruction *cmdInst);
+void handle_immediate_constant(OperandType operandType, const OperandSpan *constantSymbol, CommandInstruction *cmdInst);
 
 /**
  * @brief Inserts a fixed index operand label into the command instruction line descriptor.
@@ -532,74 +461,39 @@ void handle_immediate_constant(OperandType operandType, char *constantSymbol, Co
  * name of the fixed index operand based on the provided operand type (source or target).
  *
  * @param[in] operandType - The type of operand (source or target) to handle.
- * @param[in] label - The label name representing the fixed index operand.
+ * @param[in] label - The span of the label name representing the fixed index operand.
  * @param[in,out] cmdInst - A pointer to the command instruction line descriptor.
  *
  * @note This function assumes that the provided command instruction pointer is not NULL.
  * @note If the operand type is SOURCE_OPERAND, the label name is set for the source operand.
  * @note If the operand type is TARGET_OPERAND, the label name is set for the target operand.
- * @note Memory allocation failure is handled by printing an error message.
  *
  * @remark The insert_fixed_index_label function is used to insert fixed index operand labels into command instructions.
  */
-void insert_fixed_index_label(OperandType operandType, char *label, CommandInstruction *cmdInst);
+void insert_fixed_index_label(OperandType operandType, const OperandSpan *label, CommandInstruction *cmdInst);
 
 /**
  * @brief Handles fixed-index indexing for command operands.
  *
- * This function handles the fixed-index indexing for command operands, updating the command instruction structure
- * accordingly based on the operand type, index representation (integer or constant), and the value of the index.
- * It ensures proper memory allocation and error handling while updating the command instruction structure.
+ * This function stores the index of a classified fixed index addressing operand in the command instruction
+ * structure, based on the operand type and the index representation (integer or constant).
  *
  * @param[in] operandType - The type of the operand (source or target).
- * @param[in] isInteger - Indicates whether the index is represented by an integer.
- * @param[in] isConstant - Indicates whether the index is represented by a constant.
- * @param[in] integerValue - The value of the index if it is represented by an integer.
- * @param[in] constantSymbol - The symbol representing the index if it is represented by a constant.
+ * @param[in] classified - The classified fixed index addressing operand.
  * @param[in, out] cmdInst - A pointer to the command instruction structure to be updated.
- * @return True if the operation succeeds, false otherwise.
  *
  * @note This function assumes that the command instruction structure (cmdInst) is properly initialized.
- * @note This function handles both source and target operands, updating the appropriate fields in the command instruction structure.
  * @note Fixed-index indexing can be represented by either an integer value or a constant symbol.
- * @note Memory allocation is managed to prevent memory leaks, and proper error handling is implemented.
- *
- * @remark The handle_fixed_index_indexing function is essential for processing command operands with fixed-index indexing,
- *          ensuring accurate representation and updating of the command instruction structure.
  *
  * @algorithm
- * 1. Check for valid input: If the command instruction structure (cmdInst) is NULL, return false.
+ * 1. Check for valid input: If the command instruction structure (cmdInst) is NULL, return.
  * 2. If the index is represented by an integer:
  *    a. Update the appropriate field in the command instruction structure based on the operand type.
  *    b. Set the constant addressing index to NULL to avoid dangling pointers.
- *    c. Return true to indicate successful completion.
- * 3. If the index is represented by a constant symbol:
- *    a. Update the appropriate field in the command instruction structure based on the operand type.
- *    b. Allocate memory for the constant addressing index and duplicate the constant symbol.
- *    c. Handle memory allocation failure and return false if necessary.
- *    d. Return true to indicate successful completion.
- * 4. If none of the conditions are met, return false to indicate an error.
- *
- * @example
- * Example of usage:
- * \code
- * OperandType operandType = SOURCE_OPERAND;
- * bool isInteger = true;
- * bool isConstant = false;
- * int integerValue = 10;
- * char *constantSymbol = NULL;
- * CommandInstruction cmdInst;
- * // Assume cmdInst is properly initialized
- * if (handle_fixed_index_indexing(operandType, isInteger, isConstant, integerValue, constantSymbol, &cmdInst)) {
- *     // Fixed-index indexing handled successfully
- * } else {
- *     // Error occurred while handling fixed-index indexing
- * }
- * \endcode
+ * 3. Otherwise, duplicate the constant symbol into the appropriate field based on the operand type.
  */
-bool handle_fixed_index_indexing(OperandType operandType, bool isInteger, bool isConstant, int integerValue,
-                                 char *constantSymbol, CommandInstruction *cmdInst);
+void handle_fixed_index_indexing(OperandType operandType, const ClassifiedOperand *classified,
+                                 CommandInstruction *cmdInst);
 
 
 #endif /**< ADDRESSING_ANALYSIS_H */
-
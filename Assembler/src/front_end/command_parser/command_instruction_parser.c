@@ -254,73 +254,40 @@ void handle_no_operands_opcode(char *line, AbstractLineDescriptor *lineDescripto
 /* Handles the validation and processing of a command instruction operand */
 bool handle_operand(char *operand, OperandType operandType, AbstractLineDescriptor *lineDescriptor) {
 
-    /* Check if the addressing is an 'immediate addressing' (0) */
-    if (*operand == '#') { /**< If the first character is '#' - the addressing type is immediate addressing (0) */
+    ClassifiedOperand classified; /**< The addressing type and the parsed payload of the operand */
 
-        /* Update the line descriptor's 'operandType' field - Select if it's a source operand or a target operand */
-        if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
-            lineDescriptor->instructionType.commandInst.sourceOperandAddressingType = IMMEDIATE_ADDR;
-        }
-        else { /**< True if it's a target operand */
-            lineDescriptor->instructionType.commandInst.targetOperandAddressingType = IMMEDIATE_ADDR;
-        }
-        /* Handle the immediate addressing */
-        handle_immediate_addressing(operand, operandType, lineDescriptor);
-
-        return TRUE;
+    /* Classify the operand and parse its payload in a single scan */
+    if (classify_operand(operand, &classified) == NONE_ADDR) { /**< True if the addressing type is not recognized */
+        insert_error(lineDescriptor, COMMAND_INST_ERR OPERAND_FORMAT_ERR);
+        return FALSE;
     }
 
-        /* Check if the addressing is a 'direct addressing' (1) */
-    else if (is_direct_addressing(operand)) { /**< True if the addressing is a 'direct addressing' (1) */
-
-        /* Update the line descriptor's 'operandType' field - Select if it's a source operand or a target operand */
-        if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
-            lineDescriptor->instructionType.commandInst.sourceOperandAddressingType = DIRECT_ADDR;
-        }
-        else { /**< True if it's a target operand */
-            lineDescriptor->instructionType.commandInst.targetOperandAddressingType = DIRECT_ADDR;
-        }
-        /* Handle the direct addressing */
-        handle_direct_addressing(operand, operandType, lineDescriptor);
-
-        return TRUE;
+    /* Update the line descriptor's 'operandType' field - Select if it's a source operand or a target operand */
+    if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
+        lineDescriptor->instructionType.commandInst.sourceOperandAddressingType = classified.addressingType;
     }
-
-        /* Check if the addressing is a 'fixed index addressing' (2) */
-    else if (is_fixed_index_addressing(operand)) { /**< True if the addressing is a 'fixed index addressing' (2) */
-
-        /* Update the line descriptor's 'operandType' field - Select if it's a source operand or a target operand */
-        if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
-            lineDescriptor->instructionType.commandInst.sourceOperandAddressingType = FIXED_IDX_ADDR;
-        }
-        else { /**< True if it's a target operand */
-            lineDescriptor->instructionType.commandInst.targetOperandAddressingType = FIXED_IDX_ADDR;
-        }
-        /* Handle the fixed index addressing */
-        handle_fixed_index_addressing(operand, operandType, lineDescriptor);
-
-        return TRUE;
+    else { /**< True if it's a target operand */
+        lineDescriptor->instructionType.commandInst.targetOperandAddressingType = classified.addressingType;
     }
 
-        /* Check if the addressing is a 'direct index addressing' (3) */
-    else if (is_direct_register_addressing(operand)) { /**< True if the addressing is a 'direct register addressing' (3) */
-
-        /* Update the line descriptor's 'operandType' field - Select if it's a source operand or a target operand */
-        if (operandType == SOURCE_OPERAND) { /**< True if it's a source operand */
-            lineDescriptor->instructionType.commandInst.sourceOperandAddressingType = DIRECT_REGISTER_ADDR;
-        }
-        else { /**< True if it's a target operand */
-            lineDescriptor->instructionType.commandInst.targetOperandAddressingType = DIRECT_REGISTER_ADDR;
-        }
-        /* Handle the direct register addressing */
-        handle_direct_register_addressing(operand, operandType, lineDescriptor);
-
-        return TRUE;
+    /* Insert the parsed payload to the line descriptor */
+    switch (classified.addressingType) {
+        case IMMEDIATE_ADDR: /**< Immediate addressing (0) */
+            handle_immediate_addressing(&classified, operandType, lineDescriptor);
+            break;
+        case DIRECT_ADDR: /**< Direct addressing (1) */
+            handle_direct_addressing(&classified, operandType, lineDescriptor);
+            break;
+        case FIXED_IDX_ADDR: /**< Fixed index addressing (2) */
+            handle_fixed_index_addressing(&classified, operandType, lineDescriptor);
+            break;
+        case DIRECT_REGISTER_ADDR: /**< Direct register addressing (3) */
+            handle_direct_register_addressing(&classified, operandType, lineDescriptor);
+            break;
+        default: break;
     }
 
-    /* If reach here, there must be an error */
-    insert_error(lineDescriptor, COMMAND_INST_ERR OPERAND_FORMAT_ERR);
-    return FALSE;
+    return TRUE;
 }
 
 /* Determines the OpcodeType corresponding to a given opcode name */